@@ -70,6 +70,68 @@ def run_benchmarks
   puts "- Result: #{memory_diff.abs < 5000 ? '✅ No significant memory leak' : '⚠️ Potential memory increase'}"
   puts
 
+  puts "## Handle Lifecycle Soak"
+  puts
+
+  # One continuous scan runs across the soak and scan_results is polled while
+  # devices come and go. Every batch the scan is restarted (which clears
+  # SimpleBLE's seen list) and given time to refill, so the adapter's
+  # peripheral pool is evicted and re-wrapped as in a long-running scanner.
+  # The non-raising scan calls keep a transient stack error from aborting it.
+  cycles = Integer(ENV.fetch('SIMPLEBLE_SOAK_CYCLES', 100_000))
+  batch = Integer(ENV.fetch('SIMPLEBLE_SOAK_BATCH', 1_000))
+  refill_s = 1.0
+  scan_failures = 0
+  scan_failures += 1 if adapter.try_scan_start == :failure
+  sleep refill_s
+  GC.start
+  soak_start_memory = `ps -o rss= -p #{Process.pid}`.to_i
+
+  puts "Polling scan_results #{cycles} times, restarting the scan every #{batch} cycles..."
+  samples = []
+  pool = {}
+  devices_seen = 0
+  empty_cycles = 0
+  created = 0
+  reused = 0
+  cycles.times do |i|
+    if i.positive? && (i % batch).zero?
+      scan_failures += 1 if adapter.try_scan_stop == :failure
+      scan_failures += 1 if adapter.try_scan_start == :failure
+      sleep refill_s
+    end
+
+    devices = adapter.scan_results
+    empty_cycles += 1 if devices.empty?
+    devices_seen += devices.length
+    current = {}
+    devices.each do |device|
+      address = device.address
+      pool[address].equal?(device) ? reused += 1 : created += 1
+      current[address] = device
+    end
+    pool = current
+
+    samples << `ps -o rss= -p #{Process.pid}`.to_i if (i % (cycles / 10).clamp(1, cycles)).zero?
+  end
+  adapter.try_scan_stop
+  pool = nil
+  GC.start
+  soak_end_memory = `ps -o rss= -p #{Process.pid}`.to_i
+  soak_diff = soak_end_memory - soak_start_memory
+
+  puts "- Devices per cycle: #{(devices_seen.to_f / cycles).round(1)} avg, #{empty_cycles} empty cycles"
+  puts "- Wrappers: #{created} created, #{reused} reused"
+  puts "- Scan start/stop failures: #{scan_failures}"
+  puts "- RSS samples: #{samples.join(' KB, ')} KB"
+  puts "- Memory difference: #{soak_diff} KB"
+  if devices_seen.zero?
+    puts "- Result: ⚠️ No devices discovered - soak did not exercise handle creation"
+  else
+    puts "- Result: #{soak_diff.abs < 5000 ? '✅ Flat RSS' : '⚠️ RSS grew during soak'}"
+  end
+  puts
+
   puts "## Test Environment"
   puts
   puts "- **Platform**: #{RUBY_PLATFORM}"
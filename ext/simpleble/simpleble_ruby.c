@@ -26,42 +26,89 @@ static VALUE eCharacteristicError; // placeholder for future use
     } \
 } while(0)
 
+// Status symbols returned by the non-raising try_* methods. Interned once in
+// Init_simpleble so the failure path never allocates an exception object.
+static VALUE sym_ok;
+static VALUE sym_failure;
+static VALUE failure_pair; // frozen [:failure, nil], shared by every failed pair-returning try_*
+
+#define SIMPLEBLE_STATUS(err) ((err) == SIMPLEBLE_SUCCESS ? sym_ok : sym_failure)
+#define SIMPLEBLE_STATUS_PAIR(err, value) \
+    ((err) == SIMPLEBLE_SUCCESS ? rb_assoc_new(sym_ok, (value)) : failure_pair)
+
+// Approximate native footprint behind each SimpleBLE handle. The C API doesn't
+// expose allocation sizes, so these are estimates reported to the GC (via dsize
+// and rb_gc_adjust_memory_usage) to keep it aware of memory it can't see.
+#define ADAPTER_HANDLE_MEMSIZE 1024
+#define PERIPHERAL_HANDLE_MEMSIZE 256
+
 // Ruby object data structures - using SimpleBLE C API types
 typedef struct {
     simpleble_adapter_t adapter_handle;
+    VALUE peripherals; // address => Peripheral, reused across scan_results calls
 } adapter_data_t;
 
 typedef struct {
     simpleble_peripheral_t peripheral_handle;
+    VALUE adapter; // owning Adapter when pooled, otherwise Qnil
+    VALUE address; // pool key when pooled, otherwise Qnil
 } peripheral_data_t;
 
 // Memory management functions
+static void adapter_mark(void* ptr) {
+    adapter_data_t* data = (adapter_data_t*)ptr;
+    rb_gc_mark(data->peripherals);
+}
+
 static void adapter_free(void* ptr) {
     adapter_data_t* data = (adapter_data_t*)ptr;
     if (data->adapter_handle) {
         simpleble_adapter_release_handle(data->adapter_handle);
+        rb_gc_adjust_memory_usage(-(ssize_t)ADAPTER_HANDLE_MEMSIZE);
     }
     xfree(data);
 }
 
+static size_t adapter_memsize(const void* ptr) {
+    const adapter_data_t* data = (const adapter_data_t*)ptr;
+    return sizeof(adapter_data_t) + (data->adapter_handle ? ADAPTER_HANDLE_MEMSIZE : 0);
+}
+
 static const rb_data_type_t adapter_type = {
     "SimpleBLE::Adapter",
-    {0, adapter_free, 0, 0},
+    {adapter_mark, adapter_free, adapter_memsize, 0},
     0, 0,
     RUBY_TYPED_FREE_IMMEDIATELY,
 };
 
-static void peripheral_free(void* ptr) {
-    peripheral_data_t* data = (peripheral_data_t*)ptr;
+static void peripheral_release(peripheral_data_t* data) {
     if (data->peripheral_handle) {
         simpleble_peripheral_release_handle(data->peripheral_handle);
+        data->peripheral_handle = NULL;
+        rb_gc_adjust_memory_usage(-(ssize_t)PERIPHERAL_HANDLE_MEMSIZE);
     }
+}
+
+static void peripheral_mark(void* ptr) {
+    peripheral_data_t* data = (peripheral_data_t*)ptr;
+    rb_gc_mark(data->adapter);
+    rb_gc_mark(data->address);
+}
+
+static void peripheral_free(void* ptr) {
+    peripheral_data_t* data = (peripheral_data_t*)ptr;
+    peripheral_release(data);
     xfree(data);
 }
 
+static size_t peripheral_memsize(const void* ptr) {
+    const peripheral_data_t* data = (const peripheral_data_t*)ptr;
+    return sizeof(peripheral_data_t) + (data->peripheral_handle ? PERIPHERAL_HANDLE_MEMSIZE : 0);
+}
+
 static const rb_data_type_t peripheral_type = {
     "SimpleBLE::Peripheral",
-    {0, peripheral_free, 0, 0},
+    {peripheral_mark, peripheral_free, peripheral_memsize, 0},
     0, 0,
     RUBY_TYPED_FREE_IMMEDIATELY,
 };
@@ -75,10 +122,63 @@ static void check_adapter_data(adapter_data_t* data) {
 
 static void check_peripheral_data(peripheral_data_t* data) {
     if (!data || !data->peripheral_handle) {
-        rb_raise(eSimpleBLEError, "Peripheral not initialized");
+        rb_raise(eSimpleBLEError, "Peripheral not initialized or already released");
     }
 }
 
+static VALUE wrap_peripheral(simpleble_peripheral_t ph, VALUE adapter, VALUE address) {
+    peripheral_data_t* pdata = ALLOC(peripheral_data_t);
+    pdata->peripheral_handle = ph;
+    pdata->adapter = adapter;
+    pdata->address = address;
+    rb_gc_adjust_memory_usage(PERIPHERAL_HANDLE_MEMSIZE);
+    return TypedData_Wrap_Struct(cPeripheral, &peripheral_type, pdata);
+}
+
+/*
+ * Return the Peripheral for a freshly obtained handle, reusing a live wrapper
+ * for the same address from `current` or `previous` when there is one. SimpleBLE
+ * handles for one device share the same backend object, so the duplicate handle
+ * is released straight away instead of waiting for GC. The result is recorded
+ * in `current` under its address; wrappers created here are also appended to
+ * `created` unless it is Qnil. `*listed` is set when the address was already
+ * in `current`, i.e. the caller has already collected this peripheral.
+ */
+static VALUE pooled_peripheral(VALUE adapter, VALUE current, VALUE previous, simpleble_peripheral_t ph, VALUE created, bool* listed) {
+    *listed = false;
+    char* addr = simpleble_peripheral_address(ph);
+    if (!addr) {
+        VALUE periph = wrap_peripheral(ph, Qnil, Qnil);
+        if (!NIL_P(created)) rb_ary_push(created, periph);
+        return periph;
+    }
+    VALUE key = rb_obj_freeze(rb_str_new_cstr(addr));
+    free(addr);
+    
+    VALUE periph = rb_hash_lookup(current, key);
+    if (!NIL_P(periph)) {
+        // current only ever holds live wrappers handed out by this call
+        simpleble_peripheral_release_handle(ph);
+        *listed = true;
+        return periph;
+    }
+    periph = rb_hash_lookup(previous, key);
+    if (!NIL_P(periph)) {
+        peripheral_data_t* pdata;
+        TypedData_Get_Struct(periph, peripheral_data_t, &peripheral_type, pdata);
+        if (pdata->peripheral_handle) {
+            simpleble_peripheral_release_handle(ph);
+            rb_hash_aset(current, key, periph);
+            return periph;
+        }
+    }
+    
+    periph = wrap_peripheral(ph, adapter, key);
+    rb_hash_aset(current, key, periph);
+    if (!NIL_P(created)) rb_ary_push(created, periph);
+    return periph;
+}
+
 /*
  * call-seq:
  *   SimpleBLE::Adapter.bluetooth_enabled? -> Boolean
@@ -106,8 +206,11 @@ rb_adapter_get_adapters(VALUE self)
     for (size_t i = 0; i < count; i++) {
         simpleble_adapter_t adapter_handle = simpleble_adapter_get_handle(i);
         if (adapter_handle) {
+            VALUE pool = rb_hash_new();
             adapter_data_t* data = ALLOC(adapter_data_t);
             data->adapter_handle = adapter_handle;
+            data->peripherals = pool;
+            rb_gc_adjust_memory_usage(ADAPTER_HANDLE_MEMSIZE);
             
             VALUE adapter = TypedData_Wrap_Struct(cAdapter, &adapter_type, data);
             rb_ary_push(adapters, adapter);
@@ -117,6 +220,29 @@ rb_adapter_get_adapters(VALUE self)
     return adapters;
 }
 
+/* Shared scan implementations used by both the raising and try_* methods */
+static simpleble_err_t adapter_scan_start_impl(VALUE self) {
+    adapter_data_t* data; 
+    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
+    check_adapter_data(data);
+    return simpleble_adapter_scan_start(data->adapter_handle);
+}
+
+static simpleble_err_t adapter_scan_stop_impl(VALUE self) {
+    adapter_data_t* data; 
+    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
+    check_adapter_data(data);
+    return simpleble_adapter_scan_stop(data->adapter_handle);
+}
+
+static simpleble_err_t adapter_scan_for_impl(VALUE self, VALUE timeout_ms_val) {
+    adapter_data_t* data; 
+    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
+    check_adapter_data(data);
+    int timeout_ms = NUM2INT(timeout_ms_val);
+    return simpleble_adapter_scan_for(data->adapter_handle, timeout_ms);
+}
+
 /*
  * call-seq:
  *   adapter.scan_start -> self
@@ -126,14 +252,23 @@ rb_adapter_get_adapters(VALUE self)
 static VALUE
 rb_adapter_scan_start(VALUE self)
 {
-    adapter_data_t* data; 
-    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
-    check_adapter_data(data);
-    simpleble_err_t err = simpleble_adapter_scan_start(data->adapter_handle);
+    simpleble_err_t err = adapter_scan_start_impl(self);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eScanError, "Failed to start scan");
     return self;
 }
 
+/*
+ * call-seq:
+ *   adapter.try_scan_start -> :ok or :failure
+ *
+ * Like scan_start, but returns a status symbol instead of raising.
+ */
+static VALUE
+rb_adapter_try_scan_start(VALUE self)
+{
+    return SIMPLEBLE_STATUS(adapter_scan_start_impl(self));
+}
+
 /*
  * call-seq:
  *   adapter.scan_stop -> self
@@ -143,14 +278,23 @@ rb_adapter_scan_start(VALUE self)
 static VALUE
 rb_adapter_scan_stop(VALUE self)
 {
-    adapter_data_t* data; 
-    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
-    check_adapter_data(data);
-    simpleble_err_t err = simpleble_adapter_scan_stop(data->adapter_handle);
+    simpleble_err_t err = adapter_scan_stop_impl(self);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eScanError, "Failed to stop scan");
     return self;
 }
 
+/*
+ * call-seq:
+ *   adapter.try_scan_stop -> :ok or :failure
+ *
+ * Like scan_stop, but returns a status symbol instead of raising.
+ */
+static VALUE
+rb_adapter_try_scan_stop(VALUE self)
+{
+    return SIMPLEBLE_STATUS(adapter_scan_stop_impl(self));
+}
+
 /*
  * call-seq:
  *   adapter.scan_for(timeout_ms) -> self
@@ -160,57 +304,113 @@ rb_adapter_scan_stop(VALUE self)
 static VALUE
 rb_adapter_scan_for(VALUE self, VALUE timeout_ms_val)
 {
-    adapter_data_t* data; 
-    TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
-    check_adapter_data(data);
-    int timeout_ms = NUM2INT(timeout_ms_val);
-    simpleble_err_t err = simpleble_adapter_scan_for(data->adapter_handle, timeout_ms);
+    simpleble_err_t err = adapter_scan_for_impl(self, timeout_ms_val);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eScanError, "Failed to perform timed scan");
     return self;
 }
 
 /*
  * call-seq:
- *   adapter.scan_active? -> Boolean
+ *   adapter.try_scan_for(timeout_ms) -> :ok or :failure
+ *
+ * Like scan_for, but returns a status symbol instead of raising.
  */
 static VALUE
-rb_adapter_scan_active(VALUE self)
+rb_adapter_try_scan_for(VALUE self, VALUE timeout_ms_val)
 {
+    return SIMPLEBLE_STATUS(adapter_scan_for_impl(self, timeout_ms_val));
+}
+
+static simpleble_err_t adapter_scan_active_impl(VALUE self, bool* active) {
     adapter_data_t* data; 
     TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
     check_adapter_data(data);
-    bool active = false;
-    simpleble_err_t err = simpleble_adapter_scan_is_active(data->adapter_handle, &active);
+    *active = false;
+    return simpleble_adapter_scan_is_active(data->adapter_handle, active);
+}
+
+/*
+ * call-seq:
+ *   adapter.scan_active? -> Boolean
+ */
+static VALUE
+rb_adapter_scan_active(VALUE self)
+{
+    bool active;
+    simpleble_err_t err = adapter_scan_active_impl(self, &active);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eScanError, "Failed to query scan state");
     return active ? Qtrue : Qfalse;
 }
 
 /*
  * call-seq:
- *   adapter.scan_results -> [Peripheral, ...]
+ *   adapter.try_scan_active -> [:ok, Boolean] or [:failure, nil]
  *
- * Return peripherals discovered in last/ongoing scan.
+ * Like scan_active?, but returns a status pair instead of raising.
  */
 static VALUE
-rb_adapter_scan_results(VALUE self)
+rb_adapter_try_scan_active(VALUE self)
 {
+    bool active;
+    simpleble_err_t err = adapter_scan_active_impl(self, &active);
+    return SIMPLEBLE_STATUS_PAIR(err, active ? Qtrue : Qfalse);
+}
+
+/* Shared by scan_results and checkout_scan_results; see pooled_peripheral for `created` */
+static VALUE adapter_scan_results(VALUE self, VALUE created) {
     adapter_data_t* data; 
     TypedData_Get_Struct(self, adapter_data_t, &adapter_type, data);
     check_adapter_data(data);
     size_t count = simpleble_adapter_scan_get_results_count(data->adapter_handle);
     VALUE ary = rb_ary_new_capa(count);
+    VALUE previous = data->peripherals;
+    VALUE current = rb_hash_new();
     for (size_t i = 0; i < count; i++) {
         simpleble_peripheral_t ph = simpleble_adapter_scan_get_results_handle(data->adapter_handle, i);
         if (ph) {
-            peripheral_data_t* pdata = ALLOC(peripheral_data_t);
-            pdata->peripheral_handle = ph;
-            VALUE periph = TypedData_Wrap_Struct(cPeripheral, &peripheral_type, pdata);
-            rb_ary_push(ary, periph);
+            bool listed;
+            VALUE periph = pooled_peripheral(self, current, previous, ph, created, &listed);
+            if (!listed) {
+                rb_ary_push(ary, periph);
+            }
         }
     }
+    data->peripherals = current;
+    RB_GC_GUARD(previous);
     return ary;
 }
 
+/*
+ * call-seq:
+ *   adapter.scan_results -> [Peripheral, ...]
+ *
+ * Return peripherals discovered in last/ongoing scan.
+ *
+ * Devices seen by the previous call are returned as the same Peripheral
+ * objects (unless released), so repeated polling doesn't accumulate native
+ * handles. Devices no longer in the results are dropped from the pool.
+ */
+static VALUE
+rb_adapter_scan_results(VALUE self)
+{
+    return adapter_scan_results(self, Qnil);
+}
+
+/*
+ * call-seq:
+ *   adapter.checkout_scan_results -> [[Peripheral, ...], [Peripheral, ...]]
+ *
+ * Like scan_results, but also returns the peripherals newly wrapped by this
+ * call. Backs with_scan_results, which releases only those.
+ */
+static VALUE
+rb_adapter_checkout_scan_results(VALUE self)
+{
+    VALUE created = rb_ary_new();
+    VALUE results = adapter_scan_results(self, created);
+    return rb_assoc_new(results, created);
+}
+
 /*
  * call-seq:
  *   adapter.identifier -> String
@@ -271,15 +471,19 @@ rb_adapter_paired_peripherals(VALUE self)
     check_adapter_data(data);
     size_t count = simpleble_adapter_get_paired_peripherals_count(data->adapter_handle);
     VALUE ary = rb_ary_new_capa(count);
+    VALUE listed_here = rb_hash_new();
     for (size_t i = 0; i < count; i++) {
         simpleble_peripheral_t ph = simpleble_adapter_get_paired_peripherals_handle(data->adapter_handle, i);
         if (ph) {
-            peripheral_data_t* pdata = ALLOC(peripheral_data_t);
-            pdata->peripheral_handle = ph;
-            VALUE periph = TypedData_Wrap_Struct(cPeripheral, &peripheral_type, pdata);
-            rb_ary_push(ary, periph);
+            bool listed;
+            VALUE periph = pooled_peripheral(self, listed_here, data->peripherals, ph, Qnil, &listed);
+            if (!listed) {
+                rb_ary_push(ary, periph);
+            }
         }
     }
+    // Paired devices join the pool without evicting what the last scan found
+    rb_funcall(data->peripherals, rb_intern("update"), 1, listed_here);
     return ary;
 }
 
@@ -328,68 +532,171 @@ static VALUE rb_peripheral_address_type(VALUE self) {
 }
 
 /* connectable? */
+static simpleble_err_t peripheral_connectable_impl(peripheral_data_t* data, bool* connectable) {
+    *connectable = false;
+    return simpleble_peripheral_is_connectable(data->peripheral_handle, connectable);
+}
+
 static VALUE rb_peripheral_connectable(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    bool connectable = false;
-    simpleble_err_t err = simpleble_peripheral_is_connectable(data->peripheral_handle, &connectable);
+    bool connectable;
+    simpleble_err_t err = peripheral_connectable_impl(data, &connectable);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to query connectable state");
     return connectable ? Qtrue : Qfalse;
 }
 
+/* try_connectable -> [:ok, Boolean] or [:failure, nil] */
+static VALUE rb_peripheral_try_connectable(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return failure_pair;
+    bool connectable;
+    simpleble_err_t err = peripheral_connectable_impl(data, &connectable);
+    return SIMPLEBLE_STATUS_PAIR(err, connectable ? Qtrue : Qfalse);
+}
+
 /* connected? */
+static simpleble_err_t peripheral_connected_impl(peripheral_data_t* data, bool* connected) {
+    *connected = false;
+    return simpleble_peripheral_is_connected(data->peripheral_handle, connected);
+}
+
 static VALUE rb_peripheral_connected(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    bool connected = false;
-    simpleble_err_t err = simpleble_peripheral_is_connected(data->peripheral_handle, &connected);
+    bool connected;
+    simpleble_err_t err = peripheral_connected_impl(data, &connected);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to query connection state");
     return connected ? Qtrue : Qfalse;
 }
 
+/* try_connected -> [:ok, Boolean] or [:failure, nil] */
+static VALUE rb_peripheral_try_connected(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return failure_pair;
+    bool connected;
+    simpleble_err_t err = peripheral_connected_impl(data, &connected);
+    return SIMPLEBLE_STATUS_PAIR(err, connected ? Qtrue : Qfalse);
+}
+
 /* paired? */
+static simpleble_err_t peripheral_paired_impl(peripheral_data_t* data, bool* paired) {
+    *paired = false;
+    return simpleble_peripheral_is_paired(data->peripheral_handle, paired);
+}
+
 static VALUE rb_peripheral_paired(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    bool paired = false;
-    simpleble_err_t err = simpleble_peripheral_is_paired(data->peripheral_handle, &paired);
+    bool paired;
+    simpleble_err_t err = peripheral_paired_impl(data, &paired);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to query paired state");
     return paired ? Qtrue : Qfalse;
 }
 
+/* try_paired -> [:ok, Boolean] or [:failure, nil] */
+static VALUE rb_peripheral_try_paired(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return failure_pair;
+    bool paired;
+    simpleble_err_t err = peripheral_paired_impl(data, &paired);
+    return SIMPLEBLE_STATUS_PAIR(err, paired ? Qtrue : Qfalse);
+}
+
 /* connect */
+static simpleble_err_t peripheral_connect_impl(peripheral_data_t* data) {
+    return simpleble_peripheral_connect(data->peripheral_handle);
+}
+
 static VALUE rb_peripheral_connect(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    simpleble_err_t err = simpleble_peripheral_connect(data->peripheral_handle);
+    simpleble_err_t err = peripheral_connect_impl(data);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to connect to peripheral");
     return self;
 }
 
+/* try_connect -> :ok or :failure */
+static VALUE rb_peripheral_try_connect(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_connect_impl(data));
+}
+
 /* disconnect */
+static simpleble_err_t peripheral_disconnect_impl(peripheral_data_t* data) {
+    return simpleble_peripheral_disconnect(data->peripheral_handle);
+}
+
 static VALUE rb_peripheral_disconnect(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    simpleble_err_t err = simpleble_peripheral_disconnect(data->peripheral_handle);
+    simpleble_err_t err = peripheral_disconnect_impl(data);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to disconnect peripheral");
     return self;
 }
 
+/* try_disconnect -> :ok or :failure */
+static VALUE rb_peripheral_try_disconnect(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_disconnect_impl(data));
+}
+
 /* unpair */
+static simpleble_err_t peripheral_unpair_impl(peripheral_data_t* data) {
+    return simpleble_peripheral_unpair(data->peripheral_handle);
+}
+
 static VALUE rb_peripheral_unpair(VALUE self) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    simpleble_err_t err = simpleble_peripheral_unpair(data->peripheral_handle);
+    simpleble_err_t err = peripheral_unpair_impl(data);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eConnectionError, "Failed to unpair peripheral");
     return self;
 }
 
+/* try_unpair -> :ok or :failure */
+static VALUE rb_peripheral_try_unpair(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_unpair_impl(data));
+}
+
+/* release - free the native handle now rather than at GC time and leave the adapter's pool */
+static VALUE rb_peripheral_release(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!NIL_P(data->adapter)) {
+        adapter_data_t* adata;
+        TypedData_Get_Struct(data->adapter, adapter_data_t, &adapter_type, adata);
+        if (rb_hash_lookup(adata->peripherals, data->address) == self) {
+            rb_hash_delete(adata->peripherals, data->address);
+        }
+    }
+    peripheral_release(data);
+    return Qnil;
+}
+
+/* released? */
+static VALUE rb_peripheral_released(VALUE self) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    return data->peripheral_handle ? Qfalse : Qtrue;
+}
+
 /* tx_power */
 static VALUE rb_peripheral_tx_power(VALUE self) {
     peripheral_data_t* data; 
@@ -501,36 +808,47 @@ static simpleble_uuid_t parse_uuid(VALUE uuid_val) {
     return uuid;
 }
 
-/* read_characteristic */
-static VALUE rb_peripheral_read_characteristic(VALUE self, VALUE service_uuid, VALUE char_uuid) {
-    peripheral_data_t* data; 
-    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
-    check_peripheral_data(data);
-    
+/* read_characteristic - shared by the raising and try_* variants; stores the data (or nil) in *result */
+static simpleble_err_t peripheral_read_characteristic_impl(peripheral_data_t* data, VALUE service_uuid, VALUE char_uuid, VALUE* result) {
     simpleble_uuid_t service = parse_uuid(service_uuid);
     simpleble_uuid_t characteristic = parse_uuid(char_uuid);
     
     uint8_t* read_data = NULL;
     size_t data_length = 0;
     
+    *result = Qnil;
     simpleble_err_t err = simpleble_peripheral_read(data->peripheral_handle, service, characteristic, &read_data, &data_length);
-    SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to read characteristic");
-    
-    if (!read_data) {
-        return Qnil;
+    if (err != SIMPLEBLE_SUCCESS || !read_data) {
+        return err;
     }
     
-    VALUE result = rb_str_new((char*)read_data, data_length);
+    *result = rb_str_new((char*)read_data, data_length);
     free(read_data);
-    return result;
+    return err;
 }
 
-/* write_characteristic_request */
-static VALUE rb_peripheral_write_characteristic_request(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
+static VALUE rb_peripheral_read_characteristic(VALUE self, VALUE service_uuid, VALUE char_uuid) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    
+    VALUE result;
+    simpleble_err_t err = peripheral_read_characteristic_impl(data, service_uuid, char_uuid, &result);
+    SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to read characteristic");
+    return result;
+}
+
+/* try_read_characteristic -> [:ok, data] or [:failure, nil] */
+static VALUE rb_peripheral_try_read_characteristic(VALUE self, VALUE service_uuid, VALUE char_uuid) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return failure_pair;
+    VALUE result;
+    simpleble_err_t err = peripheral_read_characteristic_impl(data, service_uuid, char_uuid, &result);
+    return SIMPLEBLE_STATUS_PAIR(err, result);
+}
+
+/* write_characteristic_request */
+static simpleble_err_t peripheral_write_characteristic_request_impl(peripheral_data_t* data, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
     simpleble_uuid_t service = parse_uuid(service_uuid);
     simpleble_uuid_t characteristic = parse_uuid(char_uuid);
     
@@ -538,18 +856,28 @@ static VALUE rb_peripheral_write_characteristic_request(VALUE self, VALUE servic
     const uint8_t* write_data = (const uint8_t*)RSTRING_PTR(data_val);
     size_t data_length = RSTRING_LEN(data_val);
     
-    simpleble_err_t err = simpleble_peripheral_write_request(data->peripheral_handle, service, characteristic, write_data, data_length);
+    return simpleble_peripheral_write_request(data->peripheral_handle, service, characteristic, write_data, data_length);
+}
+
+static VALUE rb_peripheral_write_characteristic_request(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    check_peripheral_data(data);
+    simpleble_err_t err = peripheral_write_characteristic_request_impl(data, service_uuid, char_uuid, data_val);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to write characteristic (request)");
-    
     return self;
 }
 
-/* write_characteristic_command */
-static VALUE rb_peripheral_write_characteristic_command(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
+/* try_write_characteristic_request -> :ok or :failure */
+static VALUE rb_peripheral_try_write_characteristic_request(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
-    check_peripheral_data(data);
-    
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_write_characteristic_request_impl(data, service_uuid, char_uuid, data_val));
+}
+
+/* write_characteristic_command */
+static simpleble_err_t peripheral_write_characteristic_command_impl(peripheral_data_t* data, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
     simpleble_uuid_t service = parse_uuid(service_uuid);
     simpleble_uuid_t characteristic = parse_uuid(char_uuid);
     
@@ -557,18 +885,28 @@ static VALUE rb_peripheral_write_characteristic_command(VALUE self, VALUE servic
     const uint8_t* write_data = (const uint8_t*)RSTRING_PTR(data_val);
     size_t data_length = RSTRING_LEN(data_val);
     
-    simpleble_err_t err = simpleble_peripheral_write_command(data->peripheral_handle, service, characteristic, write_data, data_length);
+    return simpleble_peripheral_write_command(data->peripheral_handle, service, characteristic, write_data, data_length);
+}
+
+static VALUE rb_peripheral_write_characteristic_command(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    check_peripheral_data(data);
+    simpleble_err_t err = peripheral_write_characteristic_command_impl(data, service_uuid, char_uuid, data_val);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to write characteristic (command)");
-    
     return self;
 }
 
-/* read_descriptor */
-static VALUE rb_peripheral_read_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid) {
+/* try_write_characteristic_command -> :ok or :failure */
+static VALUE rb_peripheral_try_write_characteristic_command(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE data_val) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
-    check_peripheral_data(data);
-    
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_write_characteristic_command_impl(data, service_uuid, char_uuid, data_val));
+}
+
+/* read_descriptor - shared by the raising and try_* variants; stores the data (or nil) in *result */
+static simpleble_err_t peripheral_read_descriptor_impl(peripheral_data_t* data, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid, VALUE* result) {
     simpleble_uuid_t service = parse_uuid(service_uuid);
     simpleble_uuid_t characteristic = parse_uuid(char_uuid);
     simpleble_uuid_t descriptor = parse_uuid(desc_uuid);
@@ -576,24 +914,39 @@ static VALUE rb_peripheral_read_descriptor(VALUE self, VALUE service_uuid, VALUE
     uint8_t* read_data = NULL;
     size_t data_length = 0;
     
+    *result = Qnil;
     simpleble_err_t err = simpleble_peripheral_read_descriptor(data->peripheral_handle, service, characteristic, descriptor, &read_data, &data_length);
-    SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to read descriptor");
-    
-    if (!read_data) {
-        return Qnil;
+    if (err != SIMPLEBLE_SUCCESS || !read_data) {
+        return err;
     }
     
-    VALUE result = rb_str_new((char*)read_data, data_length);
+    *result = rb_str_new((char*)read_data, data_length);
     free(read_data);
-    return result;
+    return err;
 }
 
-/* write_descriptor */
-static VALUE rb_peripheral_write_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid, VALUE data_val) {
+static VALUE rb_peripheral_read_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid) {
     peripheral_data_t* data; 
     TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
     check_peripheral_data(data);
-    
+    VALUE result;
+    simpleble_err_t err = peripheral_read_descriptor_impl(data, service_uuid, char_uuid, desc_uuid, &result);
+    SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to read descriptor");
+    return result;
+}
+
+/* try_read_descriptor -> [:ok, data] or [:failure, nil] */
+static VALUE rb_peripheral_try_read_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return failure_pair;
+    VALUE result;
+    simpleble_err_t err = peripheral_read_descriptor_impl(data, service_uuid, char_uuid, desc_uuid, &result);
+    return SIMPLEBLE_STATUS_PAIR(err, result);
+}
+
+/* write_descriptor */
+static simpleble_err_t peripheral_write_descriptor_impl(peripheral_data_t* data, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid, VALUE data_val) {
     simpleble_uuid_t service = parse_uuid(service_uuid);
     simpleble_uuid_t characteristic = parse_uuid(char_uuid);
     simpleble_uuid_t descriptor = parse_uuid(desc_uuid);
@@ -602,12 +955,26 @@ static VALUE rb_peripheral_write_descriptor(VALUE self, VALUE service_uuid, VALU
     const uint8_t* write_data = (const uint8_t*)RSTRING_PTR(data_val);
     size_t data_length = RSTRING_LEN(data_val);
     
-    simpleble_err_t err = simpleble_peripheral_write_descriptor(data->peripheral_handle, service, characteristic, descriptor, write_data, data_length);
+    return simpleble_peripheral_write_descriptor(data->peripheral_handle, service, characteristic, descriptor, write_data, data_length);
+}
+
+static VALUE rb_peripheral_write_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid, VALUE data_val) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    check_peripheral_data(data);
+    simpleble_err_t err = peripheral_write_descriptor_impl(data, service_uuid, char_uuid, desc_uuid, data_val);
     SIMPLEBLE_RAISE_IF_FAILURE(err, eCharacteristicError, "Failed to write descriptor");
-    
     return self;
 }
 
+/* try_write_descriptor -> :ok or :failure */
+static VALUE rb_peripheral_try_write_descriptor(VALUE self, VALUE service_uuid, VALUE char_uuid, VALUE desc_uuid, VALUE data_val) {
+    peripheral_data_t* data; 
+    TypedData_Get_Struct(self, peripheral_data_t, &peripheral_type, data);
+    if (!data->peripheral_handle) return sym_failure;
+    return SIMPLEBLE_STATUS(peripheral_write_descriptor_impl(data, service_uuid, char_uuid, desc_uuid, data_val));
+}
+
 // Module initialization - SimpleBLE C API direct integration working locally
 void Init_simpleble(void)
 {
@@ -618,6 +985,10 @@ void Init_simpleble(void)
     cAdapter = rb_define_class_under(mSimpleBLE, "Adapter", rb_cObject);
     cPeripheral = rb_define_class_under(mSimpleBLE, "Peripheral", rb_cObject);
     
+    // Estimated native handle footprint included in ObjectSpace.memsize_of
+    rb_define_const(cAdapter, "HANDLE_MEMSIZE", INT2NUM(ADAPTER_HANDLE_MEMSIZE));
+    rb_define_const(cPeripheral, "HANDLE_MEMSIZE", INT2NUM(PERIPHERAL_HANDLE_MEMSIZE));
+    
     // Define (or fetch existing) exception classes
     eSimpleBLEError = rb_define_class_under(mSimpleBLE, "Error", rb_eStandardError);
     // Fetch subclasses defined in Ruby layer if present
@@ -637,6 +1008,12 @@ void Init_simpleble(void)
         eCharacteristicError = rb_define_class_under(mSimpleBLE, "CharacteristicError", eSimpleBLEError);
     }
     
+    // Preallocated results for the non-raising try_* methods
+    sym_ok = ID2SYM(rb_intern("ok"));
+    sym_failure = ID2SYM(rb_intern("failure"));
+    failure_pair = rb_obj_freeze(rb_assoc_new(sym_failure, Qnil));
+    rb_gc_register_mark_object(failure_pair);
+    
     // Adapter class methods
     rb_define_singleton_method(cAdapter, "bluetooth_enabled?", rb_adapter_bluetooth_enabled, 0);
     rb_define_singleton_method(cAdapter, "get_adapters", rb_adapter_get_adapters, 0);
@@ -650,6 +1027,13 @@ void Init_simpleble(void)
     rb_define_method(cAdapter, "scan_active?", rb_adapter_scan_active, 0);
     rb_define_method(cAdapter, "scan_results", rb_adapter_scan_results, 0);
     rb_define_method(cAdapter, "paired_peripherals", rb_adapter_paired_peripherals, 0);
+    rb_define_private_method(cAdapter, "checkout_scan_results", rb_adapter_checkout_scan_results, 0);
+    
+    // Adapter instance methods - non-raising variants
+    rb_define_method(cAdapter, "try_scan_start", rb_adapter_try_scan_start, 0);
+    rb_define_method(cAdapter, "try_scan_stop", rb_adapter_try_scan_stop, 0);
+    rb_define_method(cAdapter, "try_scan_for", rb_adapter_try_scan_for, 1);
+    rb_define_method(cAdapter, "try_scan_active", rb_adapter_try_scan_active, 0);
 
     // Peripheral instance methods - basic info
     rb_define_method(cPeripheral, "identifier", rb_peripheral_identifier, 0);
@@ -667,6 +1051,10 @@ void Init_simpleble(void)
     rb_define_method(cPeripheral, "disconnect", rb_peripheral_disconnect, 0);
     rb_define_method(cPeripheral, "unpair", rb_peripheral_unpair, 0);
     
+    // Peripheral instance methods - native handle lifecycle
+    rb_define_method(cPeripheral, "release", rb_peripheral_release, 0);
+    rb_define_method(cPeripheral, "released?", rb_peripheral_released, 0);
+    
     // Peripheral instance methods - service discovery and data access
     rb_define_method(cPeripheral, "services", rb_peripheral_services, 0);
     rb_define_method(cPeripheral, "manufacturer_data", rb_peripheral_manufacturer_data, 0);
@@ -679,4 +1067,17 @@ void Init_simpleble(void)
     // Peripheral instance methods - descriptor operations
     rb_define_method(cPeripheral, "read_descriptor", rb_peripheral_read_descriptor, 3);
     rb_define_method(cPeripheral, "write_descriptor", rb_peripheral_write_descriptor, 4);
+    
+    // Peripheral instance methods - non-raising variants (return :ok/:failure or [status, data])
+    rb_define_method(cPeripheral, "try_connectable", rb_peripheral_try_connectable, 0);
+    rb_define_method(cPeripheral, "try_connected", rb_peripheral_try_connected, 0);
+    rb_define_method(cPeripheral, "try_paired", rb_peripheral_try_paired, 0);
+    rb_define_method(cPeripheral, "try_connect", rb_peripheral_try_connect, 0);
+    rb_define_method(cPeripheral, "try_disconnect", rb_peripheral_try_disconnect, 0);
+    rb_define_method(cPeripheral, "try_unpair", rb_peripheral_try_unpair, 0);
+    rb_define_method(cPeripheral, "try_read_characteristic", rb_peripheral_try_read_characteristic, 2);
+    rb_define_method(cPeripheral, "try_write_characteristic_request", rb_peripheral_try_write_characteristic_request, 3);
+    rb_define_method(cPeripheral, "try_write_characteristic_command", rb_peripheral_try_write_characteristic_command, 3);
+    rb_define_method(cPeripheral, "try_read_descriptor", rb_peripheral_try_read_descriptor, 3);
+    rb_define_method(cPeripheral, "try_write_descriptor", rb_peripheral_try_write_descriptor, 4);
 }
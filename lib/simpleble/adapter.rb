@@ -6,5 +6,15 @@ module SimpleBLE
     #
     # This Ruby file provides the namespace and any additional Ruby-level
     # helper methods or functionality.
+
+    # Yields the current scan results and, when the block exits, releases the
+    # peripherals this call created. Peripherals already handed out by an
+    # earlier scan_results may be held elsewhere, so they are left untouched.
+    def with_scan_results
+      peripherals, created = checkout_scan_results
+      yield peripherals
+    ensure
+      created&.each(&:release)
+    end
   end
 end
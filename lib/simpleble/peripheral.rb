@@ -14,11 +14,25 @@ module SimpleBLE
       "#{name} (#{address})"
     end
 
+    # Yields the peripheral and releases its native handle when the block exits.
+    # This releases this very object, which scan_results shares with any other
+    # holder; the adapter hands out a fresh wrapper for the device afterwards.
+    def with_peripheral
+      yield self
+    ensure
+      release
+    end
+
     # Convenience method for write operations - uses write_request by default
     def write_characteristic(service_uuid, char_uuid, data)
       write_characteristic_request(service_uuid, char_uuid, data)
     end
 
+    # Non-raising counterpart of write_characteristic - returns :ok or :failure
+    def try_write_characteristic(service_uuid, char_uuid, data)
+      try_write_characteristic_request(service_uuid, char_uuid, data)
+    end
+
     # Helper to get service by UUID
     def service(uuid)
       services.find { |s| s['uuid'] == uuid }
@@ -59,5 +59,40 @@ RSpec.describe SimpleBLE::Adapter do
       expect(adapter.scan_active?).to be(true).or be(false) # presence check
       adapter.scan_stop
     end
+
+    describe "peripheral pool" do
+      let(:held) do
+        adapter.scan_for(300)
+        adapter.scan_results.first
+      end
+
+      before do
+        skip "Bluetooth disabled" unless SimpleBLE::Adapter.bluetooth_enabled?
+        skip "No peripherals discovered in short scan" unless held
+      end
+
+      it "returns the same wrapper for a device on subsequent scan_results calls" do
+        address = held.address
+        match = adapter.scan_results.find { |p| p.address == address }
+        skip "Peripheral dropped out of range" unless match
+        expect(match).to be(held)
+      end
+
+      it "leaves peripherals from an earlier scan usable after with_scan_results" do
+        adapter.with_scan_results { |results| expect(results).to all(be_a(SimpleBLE::Peripheral)) }
+        expect(held.released?).to be(false)
+        expect(held.address).to be_a(String)
+      end
+    end
+
+    it "returns status symbols from the non-raising scan methods" do
+      skip "Bluetooth disabled" unless SimpleBLE::Adapter.bluetooth_enabled?
+      expect(%i[ok failure]).to include(adapter.try_scan_for(200))
+      expect(%i[ok failure]).to include(adapter.try_scan_start)
+      expect(%i[ok failure]).to include(adapter.try_scan_stop)
+      status, active = adapter.try_scan_active
+      expect(%i[ok failure]).to include(status)
+      expect([true, false, nil]).to include(active)
+    end
   end
 end
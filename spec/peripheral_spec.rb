@@ -52,6 +52,69 @@ RSpec.describe SimpleBLE::Peripheral do
       end
     end
 
+    it "returns a status symbol from try_connect and try_disconnect" do
+      expect(%i[ok failure]).to include(peripheral.try_connect)
+      expect(%i[ok failure]).to include(peripheral.try_disconnect)
+    end
+
+    it "returns a status pair from the non-raising state queries" do
+      %i[try_connected try_connectable try_paired].each do |query|
+        status, value = peripheral.public_send(query)
+        expect(status).to eq(:ok).or eq(:failure)
+        expect(status == :ok ? [true, false] : [nil]).to include(value)
+      end
+    end
+
+    describe "non-raising GATT operations on an unconnected peripheral" do
+      let(:bogus_service) { "0000fff0-dead-beef-0000-000000000000" }
+      let(:bogus_char) { "0000fff1-dead-beef-0000-000000000000" }
+
+      before { peripheral.try_disconnect }
+
+      it "returns the shared frozen failure pair from try_read_characteristic" do
+        first = peripheral.try_read_characteristic(bogus_service, bogus_char)
+        second = peripheral.try_read_characteristic(bogus_service, bogus_char)
+        expect(first).to eq([:failure, nil])
+        expect(first).to be_frozen
+        expect(second).to be(first)
+      end
+
+      it "returns :failure from try_write_characteristic_request" do
+        expect(peripheral.try_write_characteristic_request(bogus_service, bogus_char, "\x01")).to eq(:failure)
+      end
+    end
+
+    it "reports its native handle footprint to ObjectSpace until released" do
+      require 'objspace'
+      live = ObjectSpace.memsize_of(peripheral)
+      expect(live).to be > SimpleBLE::Peripheral::HANDLE_MEMSIZE
+      peripheral.release
+      expect(live - ObjectSpace.memsize_of(peripheral)).to eq(SimpleBLE::Peripheral::HANDLE_MEMSIZE)
+    end
+
+    it "is replaced by a fresh wrapper on the next scan_results once released" do
+      address = peripheral.address
+      peripheral.release
+      replacement = adapter.scan_results.find { |p| p.address == address }
+      skip "Peripheral dropped out of range" unless replacement
+      expect(replacement).not_to be(peripheral)
+      expect(replacement.released?).to be(false)
+    end
+
+    it "releases its native handle at the end of with_peripheral" do
+      peripheral.with_peripheral { |p| expect(p.released?).to be(false) }
+      expect(peripheral.released?).to be(true)
+      expect { peripheral.rssi }.to raise_error(SimpleBLE::Error)
+    end
+
+    it "returns failure rather than raising from try_* once released" do
+      peripheral.release
+      expect(peripheral.try_connect).to eq(:failure)
+      expect(peripheral.try_connected).to eq([:failure, nil])
+      expect(peripheral.try_read_characteristic("180f", "2a19")).to eq([:failure, nil])
+      expect { peripheral.connect }.to raise_error(SimpleBLE::Error)
+    end
+
     # services pending implementation
   end
 end